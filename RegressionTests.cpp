@@ -0,0 +1,660 @@
+/*
+* Regression Tests
+* Checks every variant against known prime counts and against each other,
+* then times every variant against a stored baseline
+*/
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <utility>
+#include <atomic>
+#include <algorithm>
+
+// Every variant is a standalone program with the same helper names,
+// so each one is pulled into its own namespace to keep them apart.
+namespace variant1 {
+#include "Variant1.cpp"
+}
+namespace variant2 {
+#include "Variant2.cpp"
+}
+namespace variant3 {
+#include "Variant3.cpp"
+}
+namespace variant4 {
+#include "Variant4.cpp"
+}
+
+// --- Globals ---
+const std::string g_settings_file = "regression.ini";
+const std::string g_baseline_file = "benchmark_baseline.ini";
+
+// pi(10^k) for k = 0..12
+const long long g_known_prime_counts[] = {
+    0, 4, 25, 168, 1229, 9592, 78498, 664579, 5761455,
+    50847534, 455052511, 4118054813LL, 37607912018LL
+};
+const int g_max_known_exponent = 12;
+
+// Up to 10^6 the variants are compared prime by prime; above that only counts
+const int g_full_list_max_exponent = 6;
+// Variant 2 and 4 keep every prime (with its timestamp) in memory
+const int g_engine_max_exponent_limit = 8;
+
+int g_passed = 0;
+int g_failed = 0;
+
+struct FoundPrime {
+    long long prime;
+    int thread_num;
+
+    bool operator<(const FoundPrime& other) const {
+        return prime < other.prime;
+    }
+};
+
+struct Engine {
+    std::string name;
+    // Returns the number of primes found; fills 'found' unless it is null
+    long long (*run)(long long max_number, int thread_count, double& seconds, std::vector<FoundPrime>* found);
+};
+
+// Counts printed lines instead of storing them, for count-only runs
+struct LineCounter : public std::streambuf {
+    long long lines = 0;
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (ch == '\n') ++lines;
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        lines += std::count(s, s + n, '\n');
+        return n;
+    }
+};
+
+
+void check(bool ok, const std::string& description) {
+    if (ok) {
+        ++g_passed;
+        std::cout << "[PASS] " << description << std::endl;
+    }
+    else {
+        ++g_failed;
+        std::cout << "[FAIL] " << description << std::endl;
+    }
+}
+
+bool fileExists(const std::string& filename) {
+    std::ifstream file(filename);
+    return file.is_open();
+}
+
+// Same format as readConfig, but a missing file or key stays missing
+// instead of being filled in with the variants' defaults
+std::map<std::string, long long> readOptionalConfig(const std::string& filename) {
+    std::map<std::string, long long> config;
+    std::ifstream file(filename);
+    if (!file.is_open()) return config;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(0, line.find_first_not_of(" \t\n\r\f\v"));
+        line.erase(line.find_last_not_of(" \t\n\r\f\v") + 1);
+        if (line.empty() || line[0] == '#') continue;
+        std::stringstream ss(line);
+        std::string key, value;
+        if (std::getline(ss, key, '=') && std::getline(ss, value)) {
+            key.erase(key.find_last_not_of(" \t") + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            try {
+                config[key] = std::stoll(value);
+            }
+            catch (const std::exception& /*e*/) { // Unnamed variable to suppress warning
+                std::cerr << "Warning: Could not parse line: " << line << std::endl;
+            }
+        }
+    }
+    file.close();
+    return config;
+}
+
+long long getSetting(const std::map<std::string, long long>& config, const std::string& key, long long fallback) {
+    auto it = config.find(key);
+    return (it == config.end()) ? fallback : it->second;
+}
+
+// Reference answer: plain sieve of Eratosthenes
+std::vector<long long> sievePrimes(long long max_number) {
+    std::vector<long long> primes;
+    if (max_number < 2) return primes;
+
+    std::vector<bool> composite(static_cast<size_t>(max_number) + 1, false);
+    for (long long n = 2; n <= max_number; ++n) {
+        if (composite[n]) continue;
+        primes.push_back(n);
+        for (long long m = n * n; m <= max_number; m += n) {
+            composite[m] = true;
+        }
+    }
+    return primes;
+}
+
+// Reference count for large limits: segmented sieve over odd numbers,
+// so memory stays around sqrt(max_number) instead of max_number
+long long countPrimes(long long max_number) {
+    if (max_number < 2) return 0;
+
+    long long root = static_cast<long long>(std::sqrt(static_cast<double>(max_number)));
+    while (root * root > max_number) --root;
+    while ((root + 1) * (root + 1) <= max_number) ++root;
+
+    std::vector<long long> base_primes = sievePrimes(root);
+    std::vector<long long> next_multiple;
+    for (long long p : base_primes) {
+        next_multiple.push_back(p * p);
+    }
+
+    const long long segment_size = 1 << 18; // Odd numbers per segment
+    std::vector<char> composite(segment_size);
+    long long count = 1; // The prime 2
+
+    for (long long low = 3; low <= max_number; low += 2 * segment_size) {
+        long long high = std::min(low + 2 * (segment_size - 1), max_number);
+        long long length = (high - low) / 2 + 1;
+        std::fill(composite.begin(), composite.begin() + length, 0);
+
+        // Skip base_primes[0] == 2, only odd numbers are sieved
+        for (size_t i = 1; i < base_primes.size() && base_primes[i] * base_primes[i] <= high; ++i) {
+            long long m = next_multiple[i];
+            for (; m <= high; m += 2 * base_primes[i]) {
+                composite[(m - low) / 2] = 1;
+            }
+            next_multiple[i] = m;
+        }
+        count += std::count(composite.begin(), composite.begin() + length, 0);
+    }
+    return count;
+}
+
+// Parses the "[Thread: X] Found prime: N" lines printed by Variant 1 and 3
+std::vector<FoundPrime> parsePrintedPrimes(const std::string& output) {
+    std::vector<FoundPrime> found;
+    std::stringstream ss(output);
+    std::string line;
+    const std::string thread_tag = "[Thread: ";
+    const std::string prime_tag = "Found prime: ";
+
+    while (std::getline(ss, line)) {
+        size_t thread_pos = line.find(thread_tag);
+        size_t prime_pos = line.find(prime_tag);
+        if (thread_pos == std::string::npos || prime_pos == std::string::npos) continue;
+
+        FoundPrime result;
+        result.thread_num = std::stoi(line.substr(thread_pos + thread_tag.size()));
+        result.prime = std::stoll(line.substr(prime_pos + prime_tag.size()));
+        found.push_back(result);
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+std::vector<long long> primesOnly(const std::vector<FoundPrime>& found) {
+    std::vector<long long> primes;
+    primes.reserve(found.size());
+    for (const auto& result : found) primes.push_back(result.prime);
+    return primes;
+}
+
+// --- Engine Runners ---
+// Each runner launches the variant's worker exactly like its main() does,
+// but captures the results instead of printing them to the console.
+// Only the launch-to-join phase is timed; collecting the results is not.
+// Without a 'found' vector, Variant 1 and 3 output is only counted.
+
+long long runVariant1(long long max_number, int thread_count, double& seconds, std::vector<FoundPrime>* found) {
+    std::stringstream captured;
+    LineCounter counter;
+    std::streambuf* original = std::cout.rdbuf(found ? captured.rdbuf() : static_cast<std::streambuf*>(&counter));
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        auto range = variant1::getThreadRange(i, thread_count, max_number);
+        threads.emplace_back(variant1::findPrimesInRange, range.first, range.second, i + 1);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start_time;
+    seconds = diff.count();
+
+    std::cout.rdbuf(original);
+    if (!found) return counter.lines;
+
+    *found = parsePrintedPrimes(captured.str());
+    return static_cast<long long>(found->size());
+}
+
+long long runVariant2(long long max_number, int thread_count, double& seconds, std::vector<FoundPrime>* found) {
+    variant2::g_all_primes.clear();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        auto range = variant2::getThreadRange(i, thread_count, max_number);
+        threads.emplace_back(variant2::findPrimesInRange, range.first, range.second, i + 1);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start_time;
+    seconds = diff.count();
+
+    long long count = static_cast<long long>(variant2::g_all_primes.size());
+    if (found) {
+        found->clear();
+        for (const auto& result : variant2::g_all_primes) {
+            found->push_back({ result.prime, result.thread_num });
+        }
+        std::sort(found->begin(), found->end());
+    }
+
+    // Release the results now rather than holding them until the next run
+    std::vector<variant2::PrimeResult>().swap(variant2::g_all_primes);
+    return count;
+}
+
+long long runVariant3(long long max_number, int thread_count, double& seconds, std::vector<FoundPrime>* found) {
+    variant3::g_current_number = 2;
+
+    std::stringstream captured;
+    LineCounter counter;
+    std::streambuf* original = std::cout.rdbuf(found ? captured.rdbuf() : static_cast<std::streambuf*>(&counter));
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back(variant3::findPrimesAtomic, max_number, i + 1);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start_time;
+    seconds = diff.count();
+
+    std::cout.rdbuf(original);
+    if (!found) return counter.lines;
+
+    *found = parsePrintedPrimes(captured.str());
+    return static_cast<long long>(found->size());
+}
+
+long long runVariant4(long long max_number, int thread_count, double& seconds, std::vector<FoundPrime>* found) {
+    variant4::g_current_number = 2;
+    variant4::g_all_primes.clear();
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back(variant4::findPrimesAtomic, max_number, i + 1);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start_time;
+    seconds = diff.count();
+
+    long long count = static_cast<long long>(variant4::g_all_primes.size());
+    if (found) {
+        found->clear();
+        for (const auto& result : variant4::g_all_primes) {
+            found->push_back({ result.prime, result.thread_num });
+        }
+        std::sort(found->begin(), found->end());
+    }
+
+    // Release the results now rather than holding them until the next run
+    std::vector<variant4::PrimeResult>().swap(variant4::g_all_primes);
+    return count;
+}
+
+const std::vector<Engine> g_engines = {
+    { "variant1", runVariant1 },
+    { "variant2", runVariant2 },
+    { "variant3", runVariant3 },
+    { "variant4", runVariant4 },
+};
+
+// Runs an engine when only its results matter
+std::vector<FoundPrime> runUntimed(const Engine& engine, long long max_number, int thread_count) {
+    double seconds = 0.0;
+    std::vector<FoundPrime> found;
+    engine.run(max_number, thread_count, seconds, &found);
+    return found;
+}
+
+// --- Tests ---
+
+// The reference sieve and every engine must report exactly pi(10^k).
+// Up to 10^g_full_list_max_exponent the engines must also find the same primes
+// as the reference; above that they are compared on counts only.
+void testKnownPrimeCounts(int oracle_max_exponent, int engine_max_exponent, int thread_count) {
+    std::cout << "\n--- Known prime counts ---" << std::endl;
+    long long x = 1;
+    for (int k = 1; k <= g_max_known_exponent; ++k) {
+        x *= 10;
+        std::string label = "pi(" + std::to_string(x) + ")";
+
+        if (k <= oracle_max_exponent) {
+            check(countPrimes(x) == g_known_prime_counts[k],
+                "reference sieve: " + label + " = " + std::to_string(g_known_prime_counts[k]));
+        }
+        else {
+            std::cout << "[SKIP] reference sieve: " << label
+                << " (above oracle_max_exponent = " << oracle_max_exponent << ")" << std::endl;
+        }
+
+        if (k > engine_max_exponent) {
+            std::cout << "[SKIP] variants: " << label
+                << " (above engine_max_exponent = " << engine_max_exponent << ")" << std::endl;
+            continue;
+        }
+
+        std::vector<long long> reference;
+        if (k <= g_full_list_max_exponent) reference = sievePrimes(x);
+
+        for (const auto& engine : g_engines) {
+            long long count = 0;
+            bool same_primes = true;
+            if (k <= g_full_list_max_exponent) {
+                std::vector<long long> primes = primesOnly(runUntimed(engine, x, thread_count));
+                count = static_cast<long long>(primes.size());
+                same_primes = (primes == reference);
+            }
+            else {
+                double seconds = 0.0;
+                count = engine.run(x, thread_count, seconds, nullptr);
+            }
+
+            std::stringstream description;
+            description << engine.name << ": " << label << " = " << count
+                << " (expected " << g_known_prime_counts[k] << ")";
+            if (k > g_full_list_max_exponent) description << " [count only]";
+            check(count == g_known_prime_counts[k] && same_primes, description.str());
+        }
+    }
+}
+
+// All engines must agree with each other on sizes that do not split evenly
+void testEnginesAgree(int thread_count) {
+    std::cout << "\n--- Cross-check between variants ---" << std::endl;
+    const long long sizes[] = { 99991, 123457 };
+    const int thread_counts[] = { 3, thread_count };
+
+    for (long long max_number : sizes) {
+        for (int threads : thread_counts) {
+            std::vector<long long> expected = primesOnly(runUntimed(g_engines[0], max_number, threads));
+            for (size_t e = 1; e < g_engines.size(); ++e) {
+                std::vector<long long> primes = primesOnly(runUntimed(g_engines[e], max_number, threads));
+                check(primes == expected,
+                    g_engines[e].name + " matches " + g_engines[0].name + " up to " + std::to_string(max_number)
+                    + " with " + std::to_string(threads) + " threads");
+            }
+        }
+    }
+}
+
+// Variant 1 and 2 split the search space with start = i * range_per_thread + 1.
+// Every number from 2 up must land in exactly one range, and every prime must
+// be reported once, by the thread that owns its range.
+void testThreadBoundaries() {
+    std::cout << "\n--- Variant 1/2 thread boundaries ---" << std::endl;
+    const std::pair<long long, int> cases[] = {
+        { 2, 1 }, { 10, 3 }, { 10, 16 }, { 97, 97 }, { 100, 3 },
+        { 101, 4 }, { 1000, 7 }, { 100003, 8 },
+    };
+
+    for (const auto& c : cases) {
+        long long max_number = c.first;
+        int thread_count = c.second;
+        std::string label = "max_number = " + std::to_string(max_number)
+            + ", threads = " + std::to_string(thread_count);
+
+        std::vector<std::pair<long long, long long>> ranges;
+        std::vector<int> owner(static_cast<size_t>(max_number) + 1, 0);
+        bool covered_once = true;
+        for (int i = 0; i < thread_count; ++i) {
+            auto range = variant1::getThreadRange(i, thread_count, max_number);
+            covered_once = covered_once && (range == variant2::getThreadRange(i, thread_count, max_number));
+            ranges.push_back(range);
+            for (long long n = std::max(range.first, 2LL); n <= range.second; ++n) {
+                if (owner[n] != 0) covered_once = false;
+                owner[n] = i + 1;
+            }
+        }
+        for (long long n = 2; n <= max_number; ++n) {
+            if (owner[n] == 0) covered_once = false;
+        }
+        check(covered_once, "ranges cover 2.." + std::to_string(max_number) + " exactly once (" + label + ")");
+
+        std::vector<long long> reference = sievePrimes(max_number);
+        for (int e = 0; e < 2; ++e) {
+            std::vector<FoundPrime> found = runUntimed(g_engines[e], max_number, thread_count);
+            bool right_thread = true;
+            for (const auto& result : found) {
+                // A number outside 2..max_number is a range bug, not an index
+                if (result.prime < 2 || result.prime > max_number || owner[result.prime] != result.thread_num) {
+                    right_thread = false;
+                }
+            }
+            check(primesOnly(found) == reference && right_thread,
+                g_engines[e].name + " reports each prime once from its own thread (" + label + ")");
+        }
+    }
+}
+
+// Fixed reference workload for the throughput test. It is a copy of the
+// variants' trial division, so later changes to a variant cannot affect it.
+bool referenceIsPrime(long long n) {
+    if (n <= 1) return false;
+    if (n <= 3) return true;
+    if (n % 2 == 0 || n % 3 == 0) return false;
+    for (long long i = 5; i * i <= n; i = i + 6) {
+        if (n % i == 0 || n % (i + 2) == 0)
+            return false;
+    }
+    return true;
+}
+
+void referenceCount(long long start, long long end, long long* count) {
+    long long local_count = 0;
+    for (long long n = start; n <= end; ++n) {
+        if (referenceIsPrime(n)) ++local_count;
+    }
+    *count = local_count;
+}
+
+// Returns the launch-to-join time of the reference workload
+double timeReference(long long max_number, int thread_count) {
+    std::vector<long long> counts(thread_count, 0);
+    long long range_per_thread = max_number / thread_count;
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        long long start = i * range_per_thread + 1;
+        long long end = (i == thread_count - 1) ? max_number : (i + 1) * range_per_thread;
+        threads.emplace_back(referenceCount, start, end, &counts[i]);
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    std::chrono::duration<double> diff = std::chrono::high_resolution_clock::now() - start_time;
+    return diff.count();
+}
+
+struct Throughput {
+    long long numbers_per_sec;
+    long long relative_speed; // Engine speed per 10000 reference speed
+};
+
+// Times each run of the engine right after a run of the reference workload
+// and takes the medians. The machine's current speed affects both runs about
+// equally, so the relative speed stays stable while the raw speed drifts.
+Throughput measureThroughput(const Engine& engine, long long max_number, int thread_count, int runs) {
+    long long reference_size = max_number / 2;
+    std::vector<double> speeds;
+    std::vector<double> ratios;
+
+    for (int r = 0; r < std::max(runs, 1); ++r) {
+        double reference_seconds = timeReference(reference_size, thread_count);
+        double seconds = 0.0;
+        engine.run(max_number, thread_count, seconds, nullptr);
+
+        double speed = max_number / std::max(seconds, 1e-9);
+        double reference_speed = reference_size / std::max(reference_seconds, 1e-9);
+        speeds.push_back(speed);
+        ratios.push_back(speed / reference_speed);
+    }
+    std::sort(speeds.begin(), speeds.end());
+    std::sort(ratios.begin(), ratios.end());
+
+    Throughput result;
+    result.numbers_per_sec = static_cast<long long>(speeds[speeds.size() / 2]);
+    result.relative_speed = static_cast<long long>(ratios[ratios.size() / 2] * 10000);
+    return result;
+}
+
+std::string formatRelativeSpeed(long long relative_speed) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << relative_speed / 10000.0;
+    return ss.str();
+}
+
+// Fixed-size timing run per engine, compared against the stored baseline.
+// Variant 1 and 3 output is only counted here, so console speed is not measured.
+void testThroughput(long long max_number, int thread_count, int runs, int retries, long long tolerance_percent) {
+    std::cout << "\n--- Throughput (" << max_number << " numbers, " << thread_count
+        << " threads, median of " << runs << ", speed relative to a fixed reference) ---" << std::endl;
+
+    bool have_baseline = fileExists(g_baseline_file);
+    auto baseline = readOptionalConfig(g_baseline_file);
+
+    // Timings taken with other (or unknown) settings cannot be compared
+    if (have_baseline && (baseline.find("max_number") == baseline.end() || baseline.find("threads") == baseline.end())) {
+        check(false, g_baseline_file + " does not say which max_number and threads it was recorded with. "
+            "Delete it to record a new baseline");
+        return;
+    }
+    if (have_baseline && (baseline["max_number"] != max_number || baseline["threads"] != thread_count)) {
+        std::stringstream description;
+        description << g_baseline_file << " was recorded with max_number = " << baseline["max_number"]
+            << ", threads = " << baseline["threads"] << " but this run uses max_number = " << max_number
+            << ", threads = " << thread_count << ". Delete it to record a new baseline";
+        check(false, description.str());
+        return;
+    }
+
+    bool baseline_changed = !have_baseline;
+    for (const auto& engine : g_engines) {
+        Throughput measured = measureThroughput(engine, max_number, thread_count, runs);
+        std::string key = engine.name + "_relative_speed";
+
+        if (baseline.find(key) == baseline.end()) {
+            std::cout << "[INFO] " << engine.name << ": " << measured.numbers_per_sec << " numbers/sec, relative speed "
+                << formatRelativeSpeed(measured.relative_speed) << " (no baseline, recording it)" << std::endl;
+            baseline[key] = measured.relative_speed;
+            baseline_changed = true;
+            continue;
+        }
+
+        long long minimum = baseline[key] * (100 - tolerance_percent) / 100;
+
+        // A slow measurement is often another process competing for the CPU,
+        // so measure again before reporting a regression
+        for (int retry = 0; retry < retries && measured.relative_speed < minimum; ++retry) {
+            std::cout << "[INFO] " << engine.name << ": relative speed " << formatRelativeSpeed(measured.relative_speed)
+                << " is below " << formatRelativeSpeed(minimum) << ", measuring again" << std::endl;
+            Throughput again = measureThroughput(engine, max_number, thread_count, runs);
+            if (again.relative_speed > measured.relative_speed) measured = again;
+        }
+
+        std::stringstream description;
+        description << engine.name << ": " << measured.numbers_per_sec << " numbers/sec, relative speed "
+            << formatRelativeSpeed(measured.relative_speed) << " (baseline " << formatRelativeSpeed(baseline[key])
+            << ", minimum " << formatRelativeSpeed(minimum) << ")";
+        check(measured.relative_speed >= minimum, description.str());
+    }
+
+    // Store the measurements of any engine that had no baseline yet
+    if (baseline_changed) {
+        std::ofstream outfile(g_baseline_file);
+        outfile << "# Delete this file to record a new baseline" << std::endl;
+        outfile << "# <variant>_relative_speed is the variant's speed per 10000 of the reference speed" << std::endl;
+        outfile << "max_number = " << max_number << std::endl;
+        outfile << "threads = " << thread_count << std::endl;
+        for (const auto& entry : baseline) {
+            if (entry.first == "max_number" || entry.first == "threads") continue;
+            outfile << entry.first << " = " << entry.second << std::endl;
+        }
+        outfile.close();
+        std::cout << "Baseline recorded to " << g_baseline_file << "." << std::endl;
+    }
+}
+
+// --- Main Function ---
+
+int main() {
+    std::cout << "--- Regression Tests ---" << std::endl;
+    std::cout << "Run started at: " << variant1::getCurrentTimestamp() << std::endl;
+    auto app_start_time = std::chrono::high_resolution_clock::now();
+
+    auto settings = readOptionalConfig(g_settings_file);
+    int thread_count = static_cast<int>(getSetting(settings, "threads", 4));
+    long long oracle_max_exponent = getSetting(settings, "oracle_max_exponent", 9);
+    long long engine_max_exponent = getSetting(settings, "engine_max_exponent", 6);
+    long long bench_max_number = getSetting(settings, "bench_max_number", 10000000);
+    int bench_runs = static_cast<int>(getSetting(settings, "bench_runs", 5));
+    int bench_retries = static_cast<int>(getSetting(settings, "bench_retries", 2));
+    long long tolerance_percent = getSetting(settings, "tolerance_percent", 20);
+
+    if (oracle_max_exponent > g_max_known_exponent) {
+        std::cout << "Warning: oracle_max_exponent = " << oracle_max_exponent << " is above the largest known count (10^"
+            << g_max_known_exponent << "). Using " << g_max_known_exponent << "." << std::endl;
+        oracle_max_exponent = g_max_known_exponent;
+    }
+    if (engine_max_exponent > g_engine_max_exponent_limit) {
+        std::cout << "Warning: engine_max_exponent = " << engine_max_exponent << " would not fit in memory "
+            << "(Variant 2/4 keep every prime). Using " << g_engine_max_exponent_limit << "." << std::endl;
+        engine_max_exponent = g_engine_max_exponent_limit;
+    }
+
+    std::cout << "Configuration: " << thread_count << " threads | oracle up to 10^" << oracle_max_exponent
+        << " | variants up to 10^" << engine_max_exponent << " | benchmark up to " << bench_max_number << " | tolerance " << tolerance_percent << "%." << std::endl;
+
+    testKnownPrimeCounts(static_cast<int>(oracle_max_exponent), static_cast<int>(engine_max_exponent), thread_count);
+    testEnginesAgree(thread_count);
+    testThreadBoundaries();
+    testThroughput(bench_max_number, thread_count, bench_runs, bench_retries, tolerance_percent);
+
+    auto app_end_time = std::chrono::high_resolution_clock::now();
+    std::cout << "\n" << g_passed << " passed, " << g_failed << " failed." << std::endl;
+    std::cout << "Run finished at: " << variant1::getCurrentTimestamp() << std::endl;
+
+    std::chrono::duration<double> diff = app_end_time - app_start_time;
+    std::cout << "Total execution time: " << diff.count() << " seconds" << std::endl;
+
+    return (g_failed == 0) ? 0 : 1;
+}
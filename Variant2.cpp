@@ -15,6 +15,7 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <utility>   // For std::pair
 #include <algorithm> // For std::sort
 
  // --- Globals ---
@@ -123,6 +124,21 @@ void findPrimesInRange(long long start, long long end, int thread_num) {
 }
 
 
+// Returns the [start, end] range searched by thread i
+std::pair<long long, long long> getThreadRange(int i, int thread_count, long long max_number) {
+    long long range_per_thread = max_number / thread_count;
+
+    long long start = i * range_per_thread + 1;
+    if (i == 0) start = 2; // Start from 2
+
+    long long end = (i == thread_count - 1)
+        ? max_number
+        : (i + 1) * range_per_thread;
+
+    return { start, end };
+}
+
+
 int main() {
     std::cout << "--- Variant 2 ---" << std::endl;
     std::cout << "--- Straight Division ---" << std::endl;
@@ -138,19 +154,13 @@ int main() {
     std::cout << "Searching... (This may take a moment)" << std::endl;
 
     std::vector<std::thread> threads;
-    long long range_per_thread = max_number / thread_count;
 
     // Launch threads
     for (int i = 0; i < thread_count; ++i) {
-        long long start = i * range_per_thread + 1;
-        if (i == 0) start = 2; // Start from 2
-
-        long long end = (i == thread_count - 1)
-            ? max_number
-            : (i + 1) * range_per_thread;
+        auto range = getThreadRange(i, thread_count, max_number);
 
         // Pass 'i + 1' as the new thread_num argument
-        threads.emplace_back(findPrimesInRange, start, end, i + 1);
+        threads.emplace_back(findPrimesInRange, range.first, range.second, i + 1);
     }
 
     // Wait for all threads to complete